@@ -2,6 +2,10 @@
 #include <cstring>
 #include <limits>
 #include <stdexcept>
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <string>
 
 using namespace std;
 
@@ -11,53 +15,83 @@ public:
     int music_id;
     char music_title[10];
     int music_duration;
-    Media *next;
 };
 
+// Songs live in one contiguous array in playlist order, with an ID -> index
+// map for duplicate checks and deletes. "Next" wraps around by index
+// arithmetic, so appending is O(1) and a playlist of n songs is built in
+// O(n). Deleting only marks the slot dead; the dead slots are squeezed out
+// once they outnumber the live ones, so a delete is O(1) amortized and the
+// play order never changes.
 class Playlist
 {
 private:
-    Media *head;
-
-    // Helper function for bubble sort
-    void swapNodes(Media *a, Media *b)
-    {
-        swap(a->music_id, b->music_id);
-        swap(a->music_title, b->music_title);
-        swap(a->music_duration, b->music_duration);
-    }
+    vector<Media> songs;
+    vector<bool> dead;
+    size_t dead_count = 0;
+    unordered_map<int, size_t> index_of;
 
     // Check if a song ID already exists
     bool idExists(int id)
     {
-        if (!head)
-            return false;
-        Media *temp = head;
-        do
-        {
-            if (temp->music_id == id)
-                return true;
-            temp = temp->next;
-        } while (temp != head);
-        return false;
+        return index_of.count(id) != 0;
     }
 
-public:
-    Playlist() : head(nullptr) {}
+    void reindex_from(size_t first)
+    {
+        for (size_t i = first; i < songs.size(); i++)
+            index_of[songs[i].music_id] = i;
+    }
 
-    ~Playlist()
+    // Drop the dead slots, keeping the live songs in order, and rebuild the index
+    void compact()
     {
-        if (!head)
+        if (dead_count == 0)
             return;
-        Media *current = head->next;
-        Media *next;
-        while (current != head)
+        size_t kept = 0;
+        for (size_t i = 0; i < songs.size(); i++)
         {
-            next = current->next;
-            delete current;
-            current = next;
+            if (!dead[i])
+                songs[kept++] = songs[i];
         }
-        delete head;
+        songs.resize(kept);
+        dead.assign(kept, false);
+        dead_count = 0;
+        reindex_from(0);
+    }
+
+    // Index of the first live slot at or after pos, wrapping to the front
+    size_t next_live(size_t pos) const
+    {
+        while (dead[pos % songs.size()])
+            pos++;
+        return pos % songs.size();
+    }
+
+public:
+    // Reserve room for a known number of songs, e.g. before loading a catalog
+    void reserve_songs(size_t count)
+    {
+        songs.reserve(count);
+        dead.reserve(count);
+        index_of.reserve(count);
+    }
+
+    // Append a song without prompting; returns false if the ID is taken.
+    // Titles longer than 9 characters are cut short.
+    bool add_song(int id, const char *title, int duration)
+    {
+        if (idExists(id))
+            return false;
+        Media song;
+        song.music_id = id;
+        strncpy(song.music_title, title, 9);
+        song.music_title[9] = '\0';
+        song.music_duration = duration;
+        index_of[id] = songs.size();
+        songs.push_back(song);
+        dead.push_back(false);
+        return true;
     }
 
     // Helper function to validate integer input
@@ -75,174 +109,125 @@ public:
 
     void insert_songs()
     {
-        Media *newNode = new Media;
+        Media newSong;
         cout << "Enter Music ID: ";
-        newNode->music_id = getValidIntInput();
+        newSong.music_id = getValidIntInput();
 
         // Check for duplicate ID
-        while (idExists(newNode->music_id))
+        while (idExists(newSong.music_id))
         {
             cout << "This ID already exists. Please enter a unique ID: ";
-            newNode->music_id = getValidIntInput();
+            newSong.music_id = getValidIntInput();
         }
 
         cout << "Enter Music Title (max 9 chars): ";
         cin.ignore();
-        cin.getline(newNode->music_title, 10);
+        cin.getline(newSong.music_title, 10);
 
         // Ensure null-termination
-        newNode->music_title[9] = '\0';
+        newSong.music_title[9] = '\0';
 
         cout << "Enter Music Duration in seconds: ";
-        newNode->music_duration = getValidIntInput();
+        newSong.music_duration = getValidIntInput();
 
-        if (!head)
-        {
-            head = newNode;
-            newNode->next = head;
-        }
-        else
-        {
-            Media *last = head;
-            while (last->next != head)
-            {
-                last = last->next;
-            }
-            last->next = newNode;
-            newNode->next = head;
-        }
+        add_song(newSong.music_id, newSong.music_title, newSong.music_duration);
         cout << "Song inserted successfully.\n";
     }
 
     void display_songs()
     {
-        if (!head)
+        if (size() == 0)
         {
             cout << "No songs to display." << endl;
             return;
         }
 
-        Media *temp = head;
         cout << "\n--- Songs List ---\n";
-        do
+        for (size_t i = 0; i < songs.size(); i++)
         {
-            cout << "ID: " << temp->music_id
-                 << ", Title: " << temp->music_title
-                 << ", Duration: " << temp->music_duration << " seconds" << endl;
-            temp = temp->next;
-        } while (temp != head);
+            if (dead[i])
+                continue;
+            const Media &song = songs[i];
+            cout << "ID: " << song.music_id
+                 << ", Title: " << song.music_title
+                 << ", Duration: " << song.music_duration << " seconds" << endl;
+        }
     }
 
     void delete_songs(int id)
     {
-        if (!head)
+        if (size() == 0)
         {
             cout << "Playlist is empty.\n";
             return;
         }
 
-        Media *curr = head;
-        Media *prev = nullptr;
-
-        do
+        auto it = index_of.find(id);
+        if (it == index_of.end())
         {
-            if (curr->music_id == id)
-            {
-                if (curr == head && curr->next == head)
-                {
-                    delete head;
-                    head = nullptr;
-                }
-                else if (curr == head)
-                {
-                    prev = head;
-                    while (prev->next != head)
-                        prev = prev->next;
-                    head = head->next;
-                    prev->next = head;
-                    delete curr;
-                }
-                else
-                {
-                    prev->next = curr->next;
-                    delete curr;
-                }
-                cout << "Song with ID " << id << " deleted.\n";
-                return;
-            }
-            prev = curr;
-            curr = curr->next;
-        } while (curr != head);
+            cout << "Song with ID " << id << " not found.\n";
+            return;
+        }
 
-        cout << "Song with ID " << id << " not found.\n";
+        // Leave a tombstone so the later songs keep their indices
+        dead[it->second] = true;
+        dead_count++;
+        index_of.erase(it);
+        if (dead_count > songs.size() - dead_count)
+            compact();
+        cout << "Song with ID " << id << " deleted.\n";
+    }
+
+    size_t size() const
+    {
+        return songs.size() - dead_count;
     }
 
     void count_songs()
     {
-        if (!head)
+        if (size() == 0)
         {
             cout << "The number of songs is: 0\n";
             return;
         }
-        int count = 0;
-        Media *temp = head;
-        do
-        {
-            count++;
-            temp = temp->next;
-        } while (temp != head);
-        cout << "\nThe number of songs is: " << count << "\n";
+        cout << "\nThe number of songs is: " << size() << "\n";
     }
 
     void sort_asperDuration()
     {
-        if (!head || head->next == head)
+        if (size() < 2)
         {
             cout << "No songs to display." << endl;
             return;
         }
 
-        bool swapped;
-        Media *current;
-        Media *last = nullptr;
-
-        do
-        {
-            swapped = false;
-            current = head;
-
-            while (current->next != last)
-            {
-                if (current->music_duration > current->next->music_duration)
-                {
-                    swapNodes(current, current->next);
-                    swapped = true;
-                }
-                current = current->next;
-            }
-            last = current;
-        } while (swapped);
+        compact();
+        // Stable, so songs of equal length keep their order as before
+        stable_sort(songs.begin(), songs.end(), [](const Media &a, const Media &b)
+                    { return a.music_duration < b.music_duration; });
+        reindex_from(0);
         cout << "Songs sorted by duration successfully.\n";
     }
 
     void play_inLoop()
     {
-        if (!head)
+        if (size() == 0)
         {
             cout << "No songs to play.\n";
             return;
         }
         cout << "\nPlaying songs in a continuous loop... (Enter 'q' to stop)\n";
-        Media *temp = head;
+        size_t current = next_live(0);
         string input;
         do
         {
-            cout << "Playing: " << temp->music_title << " [" << temp->music_duration << " seconds]" << endl;
+            const Media &song = songs[current];
+            cout << "Playing: " << song.music_title << " [" << song.music_duration << " seconds]" << endl;
             cout << "Enter 'n' for next song or 'q' to quit: ";
             cin >> input;
             if (input == "n")
             {
-                temp = temp->next;
+                current = next_live(current + 1);
             }
         } while (input != "q");
     }